@@ -0,0 +1,224 @@
+// char_count_compare.cpp
+// Unified serial vs SIMD comparison in a single process
+// CE-4302 Arquitectura de Computadores II
+
+#include "utils.h"
+#include "serial_counter.h"
+#include <fstream>
+
+// Per-architecture vector backend: SSE4.2/AVX dispatch on x86, NEON on ARM
+#if defined(__ARM_NEON)
+#include "neon_counter.h"
+using VectorCharacterCounter = NEONCharacterCounter;
+#else
+#include "simd_counter.h"
+#include "utf8_counter.h"
+using VectorCharacterCounter = SIMDCharacterCounter;
+#endif
+
+/**
+ * Timing results of one implementation over all repetitions
+ */
+struct ComparisonResult {
+    std::string implementationName;
+    std::vector<double> executionTimes;
+    size_t occurrences = 0;
+    double avgTime = 0.0;
+};
+
+/**
+ * Run one implementation over the shared buffer for all repetitions
+ */
+static ComparisonResult measureImplementation(CharacterCounterBase& counter, const char* str,
+                                              const TestConfiguration& config) {
+    ComparisonResult result;
+    result.implementationName = counter.getImplementationName();
+    result.executionTimes.reserve(config.repetitions);
+
+    counter.setNonTemporal(config.nonTemporalScan);
+    counter.setThreadPinning(config.pinThreads);
+
+    for (int rep = 0; rep < config.repetitions; ++rep) {
+        PerformanceMetrics metrics;
+        size_t occurrences = (config.numThreads > 1)
+            ? counter.countCharacterOccurrencesParallel(
+                  str, config.stringLength, config.targetCharacter, config.numThreads, metrics)
+            : counter.countCharacterOccurrences(
+                  str, config.stringLength, config.targetCharacter, metrics);
+
+        result.executionTimes.push_back(metrics.executionTimeMs);
+        if (rep == 0) {
+            result.occurrences = occurrences;
+        }
+    }
+
+    result.avgTime = std::accumulate(result.executionTimes.begin(), result.executionTimes.end(), 0.0)
+                     / result.executionTimes.size();
+    return result;
+}
+
+/**
+ * Export both implementations side by side into one CSV, with per-run
+ * and average speedup columns, so comparison_plot.py no longer has to
+ * stitch two files together
+ */
+static void exportComparisonCSV(const ComparisonResult& serial, const ComparisonResult& simd,
+                                const TestConfiguration& config,
+                                const std::string& filename = "comparison_results.csv") {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Error: Failed to create CSV file: " << filename << std::endl;
+        return;
+    }
+
+    double avgSpeedup = (simd.avgTime > 0) ? serial.avgTime / simd.avgTime : 0.0;
+
+    file << "# Serial vs " << simd.implementationName << " Comparison Results\n";
+    file << "# Configuration\n";
+    file << "SerialImplementation," << serial.implementationName << "\n";
+    file << "SIMDImplementation," << simd.implementationName << "\n";
+    file << "TargetCharacter," << config.targetCharacter << "\n";
+    file << "StringLength," << config.stringLength << "\n";
+    file << "Alignment," << config.alignment << "\n";
+    file << "Repetitions," << config.repetitions << "\n";
+    file << "RandomSeed," << config.randomSeed << "\n";
+    file << "Occurrences," << serial.occurrences << "\n";
+    file << std::fixed << std::setprecision(6);
+    file << "AvgSerialTimeMs," << serial.avgTime << "\n";
+    file << "AvgSIMDTimeMs," << simd.avgTime << "\n";
+    file << "AvgSpeedup," << avgSpeedup << "\n";
+    file << "\n";
+
+    file << "# Per-Run Times\n";
+    file << "Run,SerialTimeMs,SIMDTimeMs,Speedup\n";
+    for (size_t i = 0; i < serial.executionTimes.size(); ++i) {
+        double serialTime = serial.executionTimes[i];
+        double simdTime = simd.executionTimes[i];
+        double speedup = (simdTime > 0) ? serialTime / simdTime : 0.0;
+        file << (i + 1) << "," << serialTime << "," << simdTime << "," << speedup << "\n";
+    }
+
+    file.close();
+    std::cout << "Results exported to: " << filename << std::endl;
+}
+
+/**
+ * Run serial and SIMD back-to-back on the same buffer and validate
+ */
+static void runComparisonAnalysis(const TestConfiguration& config) {
+    SerialCharacterCounter serialCounter;
+    VectorCharacterCounter simdCounter;
+
+    std::cout << "\n=== Comparison Analysis ===" << std::endl;
+    std::cout << "Implementations: " << serialCounter.getImplementationName()
+              << " vs " << simdCounter.getImplementationName() << std::endl;
+    std::cout << "Target Character: '" << config.targetCharacter << "' (ASCII: " << static_cast<int>(config.targetCharacter) << ")" << std::endl;
+    std::cout << "String Length: " << config.stringLength << " bytes" << std::endl;
+    std::cout << "Memory Alignment: " << config.alignment << " bytes" << std::endl;
+    std::cout << "Repetitions: " << config.repetitions << std::endl;
+    std::cout << "Threads: " << config.numThreads << std::endl;
+    std::cout << "Random Seed: " << config.randomSeed << std::endl;
+
+    RandomStringGenerator generator(config.randomSeed);
+    generator.setHugePages(config.useHugePages);
+
+    // Acquire the input buffer once: both implementations scan the same bytes
+    void* aligned = nullptr;
+    std::unique_ptr<MappedFileInput> fileInput;
+    if (config.useFileInput) {
+        std::cout << "\nMapping input file: " << config.inputFilePath << std::endl;
+        fileInput.reset(new MappedFileInput(config.inputFilePath));
+        aligned = const_cast<char*>(fileInput->data());
+    } else {
+        std::cout << "\nGenerating deterministic random string..." << std::endl;
+        aligned = config.fastGeneration
+                ? generator.generateAlignedStringFast(config.stringLength, config.alignment, config.numThreads, config.pinThreads)
+                : generator.generateAlignedString(config.stringLength, config.alignment);
+    }
+    const char* str = static_cast<const char*>(aligned);
+
+    std::cout << "Running serial implementation..." << std::endl;
+    ComparisonResult serial = measureImplementation(serialCounter, str, config);
+
+    std::cout << "Running SIMD implementation..." << std::endl;
+    ComparisonResult simd = measureImplementation(simdCounter, str, config);
+
+    // Cross-check the implementations on the exact same buffer
+    if (!validateResults(serial.occurrences, simd.occurrences, str, config.stringLength,
+                         config.targetCharacter)) {
+        throw std::runtime_error("Serial and SIMD implementations disagree");
+    }
+    std::cout << "Validation: PASSED (both implementations found "
+              << serial.occurrences << " occurrences)" << std::endl;
+
+    size_t totalChars = config.stringLength - 1;
+    double avgSpeedup = (simd.avgTime > 0) ? serial.avgTime / simd.avgTime : 0.0;
+
+    displayCharacterOccurrences(config.targetCharacter, serial.occurrences, totalChars);
+
+    std::cout << "\n=== Comparison Results ===" << std::endl;
+    std::cout << std::fixed << std::setprecision(6);
+    std::cout << "Serial Average Time: " << serial.avgTime << " ms" << std::endl;
+    std::cout << "SIMD Average Time: " << simd.avgTime << " ms" << std::endl;
+    std::cout << "Serial Throughput: "
+              << (config.stringLength / (serial.avgTime / 1000.0)) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+    std::cout << "SIMD Throughput: "
+              << (config.stringLength / (simd.avgTime / 1000.0)) / (1024.0 * 1024.0) << " MB/s" << std::endl;
+    std::cout << "Speedup (serial/SIMD): " << avgSpeedup << "x" << std::endl;
+
+    if (config.exportCSV) {
+        exportComparisonCSV(serial, simd, config);
+    }
+
+    if (!config.useFileInput) {
+        generator.freeAlignedString(aligned);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    std::cout << "======================================================" << std::endl;
+    std::cout << "   Serial vs SIMD Character Counting Comparison      " << std::endl;
+    std::cout << "   CE-4302 Arquitectura de Computadores II           " << std::endl;
+    std::cout << "======================================================" << std::endl;
+
+    try {
+        // Configuration: command line / config file, or interactive prompts
+        TestConfiguration config;
+        if (!parseCommandLineConfiguration(argc, argv, config)) {
+            config = getUserConfiguration();
+        }
+        validateConfiguration(config);
+
+        if (config.sweepMode) {
+            // Sweep both implementations into one shared CSV
+            SerialCharacterCounter serialCounter;
+            VectorCharacterCounter simdCounter;
+            runSweepAnalysis(serialCounter, config);
+            runSweepAnalysis(simdCounter, config);
+        } else if (config.utf8Mode) {
+#if defined(__ARM_NEON)
+            throw std::invalid_argument("--utf8 requires the x86 SIMD backend");
+#else
+            // The UTF-8 analysis validates SIMD against its own scalar reference
+            runUTF8Analysis(config);
+#endif
+        } else if (config.batchSpans > 0) {
+            // Batched span mode: strings/second for both implementations
+            SerialCharacterCounter serialCounter;
+            VectorCharacterCounter simdCounter;
+            runBatchAnalysis(serialCounter, config);
+            runBatchAnalysis(simdCounter, config);
+        } else {
+            // Run both implementations on the same buffer in one process
+            runComparisonAnalysis(config);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::cout << "\nComparison completed successfully!" << std::endl;
+
+    return 0;
+}
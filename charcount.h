@@ -0,0 +1,114 @@
+#ifndef CHARCOUNT_H
+#define CHARCOUNT_H
+
+// charcount.h
+// Public API of libcharcount for embedding the counting kernels in other
+// services
+// CE-4302 Arquitectura de Computadores II
+//
+// The benchmark binaries go through the CharacterCounterBase hierarchy,
+// which costs a virtual call plus two high_resolution_clock reads per
+// invocation for the mandatory PerformanceMetrics. That overhead is noise
+// on megabyte buffers but dominates on short strings, so this header
+// exposes the same kernels as non-virtual inline functions with the
+// metrics made optional.
+//
+// Unlike the benchmark-internal APIs, buffers here are plain
+// (pointer, size) payloads with no null-terminator slot.
+
+#include "utils.h"
+
+// Per-architecture vector backend: SSE4.2/AVX dispatch on x86, NEON on ARM
+#if defined(__ARM_NEON)
+#include "neon_counter.h"
+#else
+#include "simd_counter.h"
+#endif
+
+namespace charcount {
+
+#if defined(__ARM_NEON)
+
+/**
+ * Count occurrences of target in [data, data + size)
+ * Non-virtual fast path: no metrics, no clock reads.
+ */
+inline size_t count(const char* data, size_t size, char target) {
+    return countCharacterNEON(data, size, target);
+}
+
+#else
+
+/**
+ * ISA tier resolved once on first use and shared by every call
+ */
+inline SIMDTier tier() {
+    static const SIMDTier detected = detectBestSIMDTier();
+    return detected;
+}
+
+/**
+ * Count occurrences of target in [data, data + size)
+ * Non-virtual fast path: no metrics, no clock reads. Short strings take
+ * the scalar loop, large buffers the multi-accumulator unrolled kernels,
+ * mirroring the dispatch of SIMDCharacterCounter.
+ */
+inline size_t count(const char* data, size_t size, char target) {
+    if (size < 16) {
+        size_t total = 0;
+        for (size_t i = 0; i < size; ++i) {
+            if (data[i] == target) {
+                ++total;
+            }
+        }
+        return total;
+    }
+
+    if (size >= kUnrolledThreshold) {
+        switch (tier()) {
+            case SIMDTier::AVX512BW:
+                return countCharacterAVX512Unrolled(data, size, target);
+            case SIMDTier::AVX2:
+                return countCharacterAVX2Unrolled(data, size, target);
+            default:
+                return countCharacterSSE42Unrolled(data, size, target);
+        }
+    }
+
+    switch (tier()) {
+        case SIMDTier::AVX512BW:
+            return countCharacterAVX512(data, size, target);
+        case SIMDTier::AVX2:
+            return countCharacterAVX2(data, size, target);
+        default:
+            return countCharacterSSE42(data, size, target);
+    }
+}
+
+#endif // __ARM_NEON
+
+/**
+ * Metrics-filling overload for callers that also want the timing and
+ * occurrence bookkeeping of the benchmark harness
+ */
+inline size_t count(const char* data, size_t size, char target, PerformanceMetrics& metrics) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    size_t occurrences = count(data, size, target);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+
+    metrics.executionTimeMs = duration.count() / 1000000.0;
+    metrics.memoryUsedBytes = size;
+    metrics.stringLength = size;
+    metrics.totalCharacters = size;
+    metrics.targetCharacter = target;
+    metrics.occurrences = occurrences;
+
+    return occurrences;
+}
+
+} // namespace charcount
+
+#endif // CHARCOUNT_H
@@ -0,0 +1,84 @@
+#ifndef NEON_COUNTER_H
+#define NEON_COUNTER_H
+
+// neon_counter.h
+// NEON character occurrence counting implementation (ARMv8 / Graviton)
+// CE-4302 Arquitectura de Computadores II
+
+#include "utils.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+
+/**
+ * NEON kernel: 16 bytes per iteration. vceqq_u8 yields 0xFF per matching
+ * lane, so subtracting the compare result from a byte accumulator adds 1
+ * per match; the accumulator is widened out after at most 255 blocks,
+ * before any lane can wrap.
+ */
+inline size_t countCharacterNEON(const char* str, size_t length, char targetChar) {
+    size_t total = 0;
+    size_t i = 0;
+
+    uint8x16_t targetVec = vdupq_n_u8(static_cast<uint8_t>(targetChar));
+
+    while (i + 16 <= length) {
+        size_t blocks = std::min<size_t>((length - i) / 16, 255);
+        uint8x16_t acc = vdupq_n_u8(0);
+        for (size_t b = 0; b < blocks; ++b, i += 16) {
+            uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(str + i));
+            acc = vsubq_u8(acc, vceqq_u8(block, targetVec));
+        }
+        total += vaddlvq_u8(acc); // Widening horizontal byte sum (A64)
+    }
+
+    // Handle remaining bytes
+    for (; i < length; ++i) {
+        if (str[i] == targetChar) {
+            ++total;
+        }
+    }
+
+    return total;
+}
+
+/**
+ * NEON implementation of character occurrence counter
+ * Counts occurrences of a SPECIFIC character in the string.
+ * ARMv8 always has NEON, so unlike the x86 backend there is no runtime
+ * tier dispatch; SVE support can slot in here once Graviton hardware is
+ * available to validate it.
+ */
+class NEONCharacterCounter : public CharacterCounterBase {
+public:
+    size_t countCharacterOccurrences(const char* str, size_t length, char targetChar,
+                                   PerformanceMetrics& metrics) override {
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        size_t totalOccurrences = countCharacterNEON(str, length - 1, targetChar);
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+
+        // Fill performance metrics
+        metrics.executionTimeMs = duration.count() / 1000000.0;
+        metrics.memoryUsedBytes = length;
+        metrics.stringLength = length;
+        metrics.totalCharacters = length - 1;
+        metrics.targetCharacter = targetChar;
+        metrics.occurrences = totalOccurrences;
+        metrics.simdTier = "NEON";
+        metrics.loadPath = "unaligned";
+
+        return totalOccurrences;
+    }
+
+    std::string getImplementationName() const override {
+        return "SIMD-NEON";
+    }
+};
+
+#endif // __ARM_NEON
+
+#endif // NEON_COUNTER_H
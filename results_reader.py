@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""
+CE-4302 Arquitectura de Computadores II - Taller 02
+Reader/exporter for the CCBR binary results log written by --binary-log.
+
+The format is one fixed-size little-endian header followed by fixed-size
+records (see BinaryResultsHeader/BinaryResultsRecord in utils.h), so a
+whole sweep loads with a single read + struct unpacking instead of
+re-parsing the multi-section CSV text per run.
+
+Usage:
+    python3 results_reader.py results.bin            # dump as columnar CSV
+    from results_reader import load                  # programmatic access
+"""
+import struct
+import sys
+
+MAGIC = b"CCBR"
+HEADER_FORMAT = "<4sIIIIi"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+RECORD_FORMAT = "<24sQQQddic3x"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+
+RECORD_FIELDS = (
+    "implementation", "string_length", "alignment", "occurrences",
+    "execution_time_ms", "throughput_mbps", "threads", "target_char",
+)
+
+
+def load(path):
+    """Load one CCBR log. Returns (header dict, list of record dicts)."""
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if len(data) < HEADER_SIZE:
+        raise ValueError(f"{path}: file shorter than the CCBR header")
+
+    magic, version, header_size, record_size, seed, repetitions = \
+        struct.unpack_from(HEADER_FORMAT, data)
+    if magic != MAGIC:
+        raise ValueError(f"{path}: not a CCBR results log")
+    if version != 1:
+        raise ValueError(f"{path}: unsupported CCBR version {version}")
+    if record_size != RECORD_SIZE:
+        raise ValueError(f"{path}: record size {record_size} != expected {RECORD_SIZE}")
+
+    header = {
+        "version": version,
+        "random_seed": seed,
+        "repetitions": repetitions,
+    }
+
+    records = []
+    for offset in range(header_size, len(data) - RECORD_SIZE + 1, RECORD_SIZE):
+        values = struct.unpack_from(RECORD_FORMAT, data, offset)
+        record = dict(zip(RECORD_FIELDS, values))
+        record["implementation"] = record["implementation"].rstrip(b"\0").decode("ascii")
+        record["target_char"] = record["target_char"].decode("latin-1")
+        records.append(record)
+
+    return header, records
+
+
+def dump_csv(path, out=sys.stdout):
+    """Export one log as strict columnar CSV (one header row, one row per record)."""
+    header, records = load(path)
+    out.write("# seed=%d repetitions=%d\n" % (header["random_seed"], header["repetitions"]))
+    out.write(",".join(RECORD_FIELDS) + "\n")
+    for r in records:
+        out.write("%s,%d,%d,%d,%.6f,%.6f,%d,%s\n" % (
+            r["implementation"], r["string_length"], r["alignment"], r["occurrences"],
+            r["execution_time_ms"], r["throughput_mbps"], r["threads"], r["target_char"]))
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(f"Usage: {sys.argv[0]} <results.bin>", file=sys.stderr)
+        sys.exit(1)
+    dump_csv(sys.argv[1])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+#ifndef SERIAL_COUNTER_H
+#define SERIAL_COUNTER_H
+
+// serial_counter.h
+// Serial character occurrence counting implementation
+// CE-4302 Arquitectura de Computadores II
+
+#include "utils.h"
+
+/**
+ * Serial implementation of character occurrence counter
+ */
+class SerialCharacterCounter : public CharacterCounterBase {
+public:
+    size_t countCharacterOccurrences(const char* str, size_t length, char targetChar,
+                                   PerformanceMetrics& metrics) override {
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+
+        size_t occurrences = 0;
+
+        // Serial algorithm: iterate through each character and count target occurrences
+        for (size_t i = 0; i < length - 1; ++i) {
+            if (str[i] == targetChar) {
+                occurrences++;
+            }
+        }
+
+        auto endTime = std::chrono::high_resolution_clock::now();
+        auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime);
+
+        // Fill performance metrics
+        metrics.executionTimeMs = duration.count() / 1000000.0; // Convert to milliseconds
+        metrics.memoryUsedBytes = length;
+        metrics.stringLength = length;
+        metrics.totalCharacters = length - 1; // Exclude null terminator
+        metrics.targetCharacter = targetChar;
+        metrics.occurrences = occurrences;
+        metrics.loadPath = "scalar";
+
+        return occurrences;
+    }
+
+    std::string getImplementationName() const override {
+        return "Serial";
+    }
+};
+
+#endif // SERIAL_COUNTER_H
@@ -17,6 +17,8 @@
 #include <functional>
 #include <algorithm>
 #include <numeric>
+#include <thread>
+#include <fstream>
 
 /**
  * Performance metrics structure to standardize measurements
@@ -30,12 +32,26 @@ struct PerformanceMetrics {
     size_t totalCharacters = 0;       // Total characters processed
     char targetCharacter = '\0';      // Character being searched for
     size_t occurrences = 0;           // Number of occurrences found
-    
+    std::string simdTier = "Scalar";  // ISA level used (Scalar, SSE4.2, AVX2, AVX-512BW)
+    std::string loadPath = "n/a";     // Vector load path used (aligned/unaligned)
+    std::string cacheMode = "warm";   // Cache state between runs (warm/cold/first-touch)
+    uint64_t cpuCycles = 0;           // CPU cycles (perf_event, rdtsc fallback)
+    uint64_t instructions = 0;        // Retired instructions (perf_event)
+    uint64_t cacheMisses = 0;         // Cache misses (perf_event)
+    uint64_t dtlbMisses = 0;          // dTLB load misses (perf_event)
+    size_t pageSizeBytes = 4096;      // Page size backing the scanned buffer
+    int threadsUsed = 1;              // Worker threads used for this measurement
+    std::vector<double> threadTimesMs; // Per-thread execution times (parallel mode)
+    std::vector<int> threadCpus;      // CPU each worker ran on (parallel mode)
+
     void print() const;
     void printCSVHeader() const;
     void printCSVRow() const;
     double getThroughputMBps() const;
     double getCharactersPerSecond() const;
+    double getBytesPerSecond() const;  // Raw bytes/s (histogram and scan paths)
+    double getCyclesPerByte() const;   // Cycles per payload byte
+    double getIPC() const;             // Instructions per cycle
 };
 
 /**
@@ -49,10 +65,112 @@ public:
         int warmup_runs = 5);
     
     static double calculateMedian(std::vector<double> times);
-    
+
     static std::pair<double, double> removeOutliers(const std::vector<double>& times);
 };
 
+/**
+ * Statistical summary produced by BenchmarkRunner::run
+ * All times are per-invocation milliseconds (batch time / batch size)
+ */
+struct BenchmarkStats {
+    std::vector<double> sampleTimesMs; // One per-invocation time per measured batch
+    int batchSize = 1;                 // Kernel invocations per timed batch
+    int warmupBatches = 0;             // Batches discarded before sampling
+    double meanMs = 0.0;               // Outlier-trimmed mean
+    double stdDevMs = 0.0;             // Outlier-trimmed standard deviation
+    double medianMs = 0.0;             // p50
+    double p95Ms = 0.0;
+    double p99Ms = 0.0;
+    double minMs = 0.0;
+    double maxMs = 0.0;
+    double ciHalfWidthMs = 0.0;        // 95% confidence half-width of the mean
+    bool converged = false;            // CI target reached before the sample cap
+};
+
+/**
+ * Adaptive benchmark runner
+ * Replaces the fixed repetition loop: invocations are batched so the timer
+ * overhead amortizes away on sub-64 KB inputs, warmup batches run until the
+ * running median stabilizes, and sampling continues until the 95% confidence
+ * interval of the mean converges (or the sample cap is reached). Percentiles
+ * come from the full sample set; mean/stddev are outlier-trimmed via
+ * HighPrecisionTimer::removeOutliers.
+ */
+class BenchmarkRunner {
+public:
+    /**
+     * Measure an operation adaptively
+     * @param operation Kernel invocation under test (return value is ignored
+     *                  but forces the call not to be optimized out)
+     * @param minSamples Samples collected before convergence is evaluated
+     * @param maxSamples Hard cap on collected samples
+     * @param targetCIFraction Stop once the 95% CI half-width falls below
+     *                         this fraction of the mean (default 2%)
+     */
+    static BenchmarkStats run(const std::function<size_t()>& operation,
+                              int minSamples, int maxSamples,
+                              double targetCIFraction = 0.02);
+
+    /**
+     * Summary statistics for externally collected samples, e.g. the
+     * cache-state-controlled repetition loop that cannot use batch
+     * calibration (a batch would re-warm the buffer after its first call)
+     */
+    static BenchmarkStats summarize(const std::vector<double>& sampleTimesMs);
+
+    /**
+     * Linear-interpolated percentile (pct in [0,100]) of a sorted sample set
+     */
+    static double percentile(const std::vector<double>& sortedTimes, double pct);
+};
+
+/**
+ * Bump-pointer arena for benchmark buffers
+ * Reserves one large mapped region up front and serves every test buffer
+ * from it; reset() rewinds the cursor without unmapping, so a multi-cell
+ * sweep reuses the same already-faulted pages instead of paying a fresh
+ * multi-GB malloc/free cycle (and its page-fault warmup noise) per cell.
+ */
+class ArenaAllocator {
+public:
+    /**
+     * Map the backing region once
+     * @param capacityBytes Total bytes the arena can serve between resets
+     * @param hugePages Back the region with 2 MB pages (hugetlb, THP fallback)
+     */
+    explicit ArenaAllocator(size_t capacityBytes, bool hugePages = false);
+    ~ArenaAllocator();
+
+    ArenaAllocator(const ArenaAllocator&) = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    /**
+     * Carve an aligned block out of the arena (bump pointer, no per-block
+     * bookkeeping)
+     * @throws std::bad_alloc when the remaining capacity is exhausted
+     */
+    void* allocate(size_t size, size_t alignment);
+
+    /**
+     * Rewind the cursor: previously served pointers become reusable space,
+     * the pages stay mapped and warm
+     */
+    void reset() { cursor = 0; }
+
+    size_t capacity() const { return capacityBytes; }
+    size_t used() const { return cursor; }
+    size_t pageSize() const { return pageSizeBytes; }
+    const std::string& allocationPath() const { return path; }
+
+private:
+    char* base;
+    size_t capacityBytes;
+    size_t cursor = 0;
+    size_t pageSizeBytes = 4096;
+    std::string path = "mmap";
+};
+
 /**
  * Deterministic random string generator with configurable alignment
  * Uses fixed seed for reproducible results between serial and SIMD implementations
@@ -69,7 +187,20 @@ public:
      * @return Pointer to aligned memory containing random string
      */
     void* generateAlignedString(size_t length, size_t alignment);
-    
+
+    /**
+     * Fast generation mode: fill the buffer with multiple threads using a
+     * counter-based splitmix64 PRNG in deterministic per-chunk streams
+     * keyed off the configured seed. Output is identical regardless of
+     * thread count, so serial and SIMD runs still see the same bytes, but
+     * multi-GB setup no longer dominates benchmark wall time.
+     * @param numThreads Worker threads (0 = hardware concurrency)
+     * @param pinWorkers Pin fill workers round-robin across CPUs so pages are
+     *                   first-touched on the node that will later scan them
+     */
+    void* generateAlignedStringFast(size_t length, size_t alignment, int numThreads = 0,
+                                    bool pinWorkers = false);
+
     /**
      * Free previously allocated aligned string
      * @param alignedPtr Pointer returned by generateAlignedString
@@ -80,25 +211,154 @@ public:
      * Reset generator to initial seed state for reproducible results
      */
     void resetSeed();
-    
+
     /**
      * Get current seed value
      */
     uint32_t getSeed() const { return seed; }
 
+    /**
+     * Back subsequent allocations with huge pages: mmap(MAP_HUGETLB) when a
+     * hugetlb pool is configured, otherwise an anonymous mapping with
+     * madvise(MADV_HUGEPAGE) so transparent huge pages can promote it.
+     * Multi-GB scans with 4 KB pages lose a measurable cycle share to dTLB
+     * page walks; 2 MB pages cut the TLB reach problem by 512x.
+     */
+    void setHugePages(bool enabled) { hugePages = enabled; }
+
+    /**
+     * Page size backing the most recent allocation (4096 when huge pages
+     * were disabled or unavailable)
+     */
+    size_t getLastPageSize() const { return lastPageSize; }
+
+    /**
+     * Allocation route of the most recent allocation
+     * ("malloc", "hugetlb-2MB" or "thp-madvise")
+     */
+    const std::string& getLastAllocationPath() const { return lastAllocationPath; }
+
+    /**
+     * Serve subsequent allocations from an arena instead of malloc/mmap.
+     * Arena-served pointers are reclaimed by ArenaAllocator::reset();
+     * freeAlignedString becomes a no-op for them.
+     */
+    void setArena(ArenaAllocator* arenaAllocator) { arena = arenaAllocator; }
+
+    /**
+     * Align a pointer inside a larger raw block (std::align semantics).
+     * Also used by the io_uring pipeline to place its I/O buffers on
+     * page boundaries.
+     */
+    static void* align(size_t alignment, size_t size, void* ptr, size_t space);
+
 private:
     std::mt19937 rng;
     uint32_t seed;
     std::unordered_map<void*, void*> originalPointers;
-    
-    void* align(size_t alignment, size_t size, void* ptr, size_t space);
+    std::unordered_map<void*, std::pair<void*, size_t>> mappedRegions;
+    ArenaAllocator* arena = nullptr;
+    bool hugePages = false;
+    size_t lastPageSize = 4096;
+    std::string lastAllocationPath = "malloc";
+
+    void* allocateAligned(size_t length, size_t alignment);
+    void* allocateHugePages(size_t length, size_t alignment);
     void generateRandomUTF8(char* buffer, size_t length);
+    void fillRandomFastParallel(char* buffer, size_t length, int numThreads, bool pinWorkers);
+};
+
+/**
+ * Hardware performance counter session (Linux perf_event + rdtsc)
+ * Wraps a measured region with cycle, instruction and cache-miss counts so
+ * bandwidth-bound regressions can be distinguished from frontend-bound ones.
+ * Falls back to rdtsc-only cycle counting when perf_event is unavailable
+ * (e.g. restricted perf_event_paranoid); the other counters then read 0.
+ */
+class HardwareCounters {
+public:
+    HardwareCounters();
+    ~HardwareCounters();
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    /**
+     * Begin a measured region
+     */
+    void start();
+
+    /**
+     * End the region and fill cpuCycles/instructions/cacheMisses
+     */
+    void stop(PerformanceMetrics& metrics);
+
+    /**
+     * Whether perf_event counters could be opened (rdtsc always works)
+     */
+    bool isAvailable() const { return perfAvailable; }
+
+private:
+    int cyclesFd;
+    int instructionsFd;
+    int cacheMissesFd;
+    int dtlbMissesFd;
+    bool perfAvailable;
+    uint64_t startTsc;
+
+    static int openCounter(uint32_t type, uint64_t counterConfig);
+    static uint64_t readCounter(int fd);
+};
+
+/**
+ * Memory-mapped file input provider
+ * Maps an input file read-only with mmap and hands the region straight to
+ * the counters, so multi-GB corpora are scanned zero-copy (no allocation,
+ * no read() copy). Advises the kernel for sequential access and huge pages.
+ */
+class MappedFileInput {
+public:
+    explicit MappedFileInput(const std::string& path);
+    ~MappedFileInput();
+
+    MappedFileInput(const MappedFileInput&) = delete;
+    MappedFileInput& operator=(const MappedFileInput&) = delete;
+
+    /**
+     * Pointer to the mapped file contents (page-aligned)
+     */
+    const char* data() const { return mappedData; }
+
+    /**
+     * File size in bytes
+     */
+    size_t size() const { return fileSize; }
+
+    /**
+     * Query the size of a file without mapping it
+     * @throws std::runtime_error if the file cannot be accessed
+     */
+    static size_t queryFileSize(const std::string& path);
+
+private:
+    char* mappedData;
+    size_t fileSize;
+    int fd;
 };
 
 /**
  * Base class for character counting algorithms
  * Ensures consistent interface between serial and SIMD versions
  */
+/**
+ * One input string of the batched counting API: a plain (pointer, size)
+ * payload with no null-terminator slot, unlike the single-buffer APIs
+ */
+struct StringSpan {
+    const char* data;
+    size_t size;
+};
+
 class CharacterCounterBase {
 public:
     virtual ~CharacterCounterBase() = default;
@@ -113,11 +373,178 @@ public:
      */
     virtual size_t countCharacterOccurrences(const char* str, size_t length, char targetChar,
                                            PerformanceMetrics& metrics) = 0;
-    
+
+    /**
+     * Count occurrences of targetChar ignoring ASCII case
+     * Single pass over the original buffer; replaces lowercasing a full
+     * copy of the input (an extra pass plus an input-sized allocation)
+     * before calling the exact-match API.
+     * @return Number of case-folded matches
+     */
+    virtual size_t countCharacterOccurrencesIgnoreCase(const char* str, size_t length,
+                                                      char targetChar, PerformanceMetrics& metrics);
+
+    /**
+     * Count bytes inside the inclusive range [rangeLow, rangeHigh]
+     * Covers "any of [0-9]" style character classes in one pass; bytes are
+     * compared as unsigned values.
+     * @return Number of bytes within the range
+     */
+    virtual size_t countCharacterRange(const char* str, size_t length,
+                                      char rangeLow, char rangeHigh,
+                                      PerformanceMetrics& metrics);
+
+    /**
+     * Count occurrences using multiple threads over cache-line-aligned chunks
+     * Splits the input, runs the single-threaded kernel per chunk and reduces
+     * the partial counts. Falls back to the single-threaded path for small
+     * inputs or numThreads <= 1.
+     * @param numThreads Number of worker threads to use
+     */
+    virtual size_t countCharacterOccurrencesParallel(const char* str, size_t length, char targetChar,
+                                                   int numThreads, PerformanceMetrics& metrics);
+
+    /**
+     * Count occurrences of several target characters in a single pass
+     * Avoids one full memory sweep per target when multiple counts are
+     * needed from the same buffer (e.g. '\n', ',', '\"' in log parsing).
+     * @param targetChars Characters to count
+     * @return Per-character counts, in the same order as targetChars
+     */
+    virtual std::vector<size_t> countMultipleCharacters(const char* str, size_t length,
+                                                       const std::vector<char>& targetChars,
+                                                       PerformanceMetrics& metrics);
+
+    /**
+     * Count occurrences of targetChar in a whole batch of short strings
+     * with one call. Per-call overhead (virtual dispatch, metrics clock
+     * reads, sub-16-byte scalar fallback) dominates actual scanning in the
+     * many-short-strings regime, so it is paid once per batch here instead
+     * of once per string. Spans carry no terminator slot; every span byte
+     * is scanned.
+     * @param spans Array of (pointer, size) input spans
+     * @param counts Receives one occurrence count per span, in order
+     */
+    virtual void countCharacterBatch(const StringSpan* spans, size_t spanCount, char targetChar,
+                                    std::vector<size_t>& counts, PerformanceMetrics& metrics);
+
+    /**
+     * Find the offset of the first occurrence of targetChar
+     * @return Offset of the first match, or npos if absent
+     */
+    virtual size_t findFirst(const char* str, size_t length, char targetChar);
+
+    /**
+     * Collect the offsets of every occurrence of targetChar
+     * Positions are appended to the (ideally preallocated) index vector,
+     * giving e.g. a newline-offset index in one scan instead of repeated
+     * memchr passes.
+     * @param positions Output vector of match offsets
+     * @return Number of matches found
+     */
+    virtual size_t collectPositions(const char* str, size_t length, char targetChar,
+                                  std::vector<size_t>& positions, PerformanceMetrics& metrics);
+
+    /**
+     * Count (possibly overlapping) occurrences of a multi-byte needle
+     * One pass over the buffer instead of shelling out to a separate tool
+     * for delimiter-pair counting.
+     * @param needle Pattern of 1 or more bytes
+     * @return Number of positions where the needle matches
+     */
+    virtual size_t countSubstringOccurrences(const char* str, size_t length,
+                                           const std::string& needle,
+                                           PerformanceMetrics& metrics);
+
+    /**
+     * Sentinel offset returned by findFirst when the character is absent
+     */
+    static const size_t npos = static_cast<size_t>(-1);
+
+    /**
+     * Compute the full 256-bin byte-frequency histogram in a single pass
+     * Replaces 256 invocations of the one-character API for entropy and
+     * encoding-detection workloads; throughput is reported as bytes/s via
+     * PerformanceMetrics::getBytesPerSecond().
+     * @return 256 counts, indexed by unsigned byte value
+     */
+    virtual std::vector<size_t> computeByteHistogram(const char* str, size_t length,
+                                                    PerformanceMetrics& metrics);
+
+    /**
+     * Request cache-bypassing (non-temporal) loads for subsequent scans
+     * Meaningful for single-pass scans of buffers much larger than LLC,
+     * where polluting the cache hurts co-located work more than the scan
+     * itself gains from it. Implementations without such a path ignore it.
+     */
+    virtual void setNonTemporal(bool) {}
+
+    /**
+     * Toggle the compile-time specialized kernels for known fixed payload
+     * sizes (e.g. 4096-byte pages). Enabled by default in implementations
+     * that have them; disabling forces the generic loop, which is what the
+     * fixed-kernel comparison mode measures against. Implementations
+     * without specializations ignore it.
+     */
+    virtual void setFixedSizeKernels(bool) {}
+
+    /**
+     * Force a specific ISA tier by name ("SSE4.2", "AVX2", "AVX-512BW")
+     * instead of the runtime dispatcher's default. Used to replay an
+     * auto-tuned choice; on some parts the widest supported tier is not
+     * the fastest one (e.g. AVX-512 license-based downclocking).
+     * @return true when the tier was applied, false when this CPU or
+     *         implementation does not support it
+     */
+    virtual bool setKernelTier(const std::string&) { return false; }
+
+    /**
+     * Pin parallel workers round-robin across CPUs. On multi-socket hosts
+     * this keeps each worker on the node whose pages it first-touched during
+     * generation, instead of letting the scheduler migrate it to a remote
+     * node at ~60% of local bandwidth.
+     */
+    void setThreadPinning(bool enabled) { pinThreads = enabled; }
+
     /**
      * Get implementation name for reporting
      */
     virtual std::string getImplementationName() const = 0;
+
+protected:
+    bool pinThreads = false;
+};
+
+/**
+ * Incremental character counter for data larger than RAM
+ * Accepts the input in arbitrary chunks via feed() and carries the running
+ * totals across chunk boundaries, so a 200 GB scan never needs the whole
+ * buffer resident. Counting runs through the wrapped counter's kernel.
+ */
+class StreamingCharacterCounter {
+public:
+    StreamingCharacterCounter(CharacterCounterBase& counter, char targetChar);
+
+    /**
+     * Count occurrences in the next chunk of the stream
+     */
+    void feed(const char* data, size_t size);
+
+    /**
+     * Finish the stream and fill the aggregated metrics
+     * @return Total occurrences across all fed chunks
+     */
+    size_t finalize(PerformanceMetrics& metrics);
+
+    size_t getBytesProcessed() const { return bytesProcessed; }
+
+private:
+    CharacterCounterBase& counter;
+    char targetChar;
+    size_t totalOccurrences;
+    size_t bytesProcessed;
+    double kernelTimeMs;
+    std::string simdTier;
 };
 
 /**
@@ -131,12 +558,65 @@ struct TestConfiguration {
     bool showDetailedResults;
     uint32_t randomSeed;
     char targetCharacter;             // Character to search for
+    std::string targetSubstring;      // Multi-byte needle (empty = single character)
+    int numThreads;                   // Worker threads (1 = single-threaded)
+    bool useFileInput;                // Count characters from a mapped file
+    std::string inputFilePath;        // Path of the input file (file mode)
+    bool useStreamingIO;              // Double-buffered read() pipeline instead of mmap
+    bool useIoUring;                  // io_uring deep-queue async read pipeline
+    bool sweepMode;                   // Iterate a length x alignment grid in one process
+    std::vector<size_t> sweepLengths;    // Lengths of the sweep grid
+    std::vector<size_t> sweepAlignments; // Alignments of the sweep grid
+    bool fastGeneration;              // Parallel counter-based string generation
+    bool nonTemporalScan;             // Cache-bypassing loads for single-pass scans
+    bool pinThreads;                  // Pin workers to CPUs (NUMA first-touch locality)
+    bool useHugePages;                // Back the buffer with 2 MB pages (hugetlb/THP)
+    bool compareFixedKernels;         // Benchmark generic vs fixed-size specialized kernels
+    bool utf8Mode;                    // UTF-8 code point counting mode (x86 backend only)
+    std::string binaryLogPath;        // Append per-run records to a CCBR binary log (empty = off)
+    std::string baselinePath;         // Baseline store for regression detection (empty = off)
+    bool updateBaseline;              // Overwrite the stored baseline instead of comparing
+    std::string cacheMode;            // Cache state between runs: warm, cold, first-touch
+    std::string tuneCachePath;        // Auto-tune cache file (empty = off)
+    size_t batchSpans;                // Short spans per batch in batch mode (0 = off)
 };
 
+/**
+ * Auto-tuned execution parameters for one CPU model
+ */
+struct TuningChoice {
+    std::string tier;      // ISA tier name (empty = keep the dispatcher default)
+    bool nonTemporal;      // Cache-bypassing loads pay off on large scans
+    int threads;           // Fastest worker thread count for parallel scans
+};
+
+/**
+ * Load the tuning choice cached for this CPU model and apply it to the
+ * counter; on a cache miss, micro-benchmark the candidate tiers, load
+ * modes and thread counts over a few representative sizes and persist
+ * the winner, so later runs on the same host skip the calibration.
+ */
+TuningChoice applyAutoTuning(CharacterCounterBase& counter, const TestConfiguration& config);
+
 /**
  * Utility functions
  */
 TestConfiguration getUserConfiguration();
+
+/**
+ * Default configuration used as the base for CLI/config-file runs
+ */
+TestConfiguration makeDefaultConfiguration();
+
+/**
+ * Fill the configuration from command-line arguments (and an optional
+ * key=value config file via --config) without interactive prompts
+ * @return true if arguments were given (non-interactive mode), false if
+ *         the caller should fall back to getUserConfiguration()
+ * @throws std::invalid_argument on unknown or malformed options
+ */
+bool parseCommandLineConfiguration(int argc, char* argv[], TestConfiguration& config);
+
 void validateConfiguration(const TestConfiguration& config);
 bool isPowerOfTwo(size_t value);
 bool validateResults(size_t serialCount, size_t simdCount, const char* str, size_t length, char targetChar);
@@ -145,14 +625,129 @@ bool validateResults(size_t serialCount, size_t simdCount, const char* str, size
  * Performance analysis functions
  */
 void runPerformanceAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
-void runImprovedPerformanceAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
+
+/**
+ * Streaming file scan: double-buffered reader overlapping file I/O with
+ * counting, so disk and CPU run concurrently on inputs larger than RAM
+ * @param chunkSize Size of each of the two I/O buffers
+ * @return Total occurrences in the file
+ */
+size_t countCharacterInFileStreaming(CharacterCounterBase& counter, const std::string& path,
+                                    char targetChar, PerformanceMetrics& metrics,
+                                    size_t chunkSize = (size_t(8) << 20));
+void runStreamingFileAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
+
+/**
+ * io_uring file scan: keeps a deep queue of async reads in flight into a
+ * ring of page-aligned buffers and scans each completed chunk while the
+ * kernel fills the others, overlapping storage latency with compute more
+ * aggressively than the two-buffer streaming reader
+ * @param queueDepth Number of reads kept in flight (= number of ring buffers)
+ * @param chunkSize Size of each ring buffer
+ * @return Total occurrences in the file
+ * @throws std::runtime_error when io_uring is unavailable on this kernel
+ */
+size_t countCharacterInFileIoUring(CharacterCounterBase& counter, const std::string& path,
+                                   char targetChar, PerformanceMetrics& metrics,
+                                   unsigned queueDepth = 8,
+                                   size_t chunkSize = (size_t(1) << 20));
+
+/**
+ * True when the running kernel supports io_uring (probed once with a
+ * throwaway one-entry ring)
+ */
+bool ioUringAvailable();
+
+void runIoUringFileAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
+
+/**
+ * Benchmark sweep over a cartesian length x alignment grid in one process
+ * Generates a single buffer per length (at maximum alignment, with offset
+ * pointers for the misaligned cells) instead of re-launching the binary and
+ * regenerating the string for every grid cell. Appends one row per cell to
+ * sweep_results.csv.
+ */
+void runSweepAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
+
+/**
+ * Benchmark the generic kernels against the compile-time specialized
+ * fixed-size kernels on the same buffer. Only lengths with a
+ * specialization (e.g. 4096) exercise the fixed path; for other lengths
+ * both measurements fall through to the generic kernel and the run says so.
+ */
+void runFixedKernelComparison(CharacterCounterBase& counter, const TestConfiguration& config);
+
+/**
+ * Benchmark the batched span API in the many-short-strings regime:
+ * config.batchSpans spans of 30-200 bytes sliced from one backing buffer,
+ * counted with one countCharacterBatch call per sample. Reports
+ * strings/second rather than MB/s — amortizing per-call overhead, not
+ * bandwidth, is what the batch API is for.
+ */
+void runBatchAnalysis(CharacterCounterBase& counter, const TestConfiguration& config);
 
 /**
  * Display and export functions
  */
 void displayCharacterOccurrences(char targetChar, size_t occurrences, size_t totalChars);
-void exportResultsCSV(char targetChar, size_t occurrences, size_t totalChars, 
+void exportResultsCSV(char targetChar, size_t occurrences, size_t totalChars,
                      const std::vector<double>& executionTimes, const TestConfiguration& config,
-                     const std::string& filename = "results.csv");
+                     const std::string& filename = "results.csv",
+                     const std::string& implName = "",
+                     const PerformanceMetrics* hwMetrics = nullptr);
+
+/**
+ * Compact binary results format ("CCBR"): one fixed-size header written
+ * when the file is created, then fixed-size little-endian records appended
+ * per measured run. Appending is O(1) and readers (results_reader.py) can
+ * load a whole 10k-run sweep with one read instead of re-parsing the
+ * multi-section CSV text per run.
+ */
+#pragma pack(push, 1)
+struct BinaryResultsHeader {
+    char magic[4];           // "CCBR"
+    uint32_t version;        // Format version (currently 1)
+    uint32_t headerSize;     // sizeof(BinaryResultsHeader)
+    uint32_t recordSize;     // sizeof(BinaryResultsRecord)
+    uint32_t randomSeed;     // TestConfiguration fields carried once
+    int32_t repetitions;
+};
+
+struct BinaryResultsRecord {
+    char implementation[24]; // Implementation name, NUL-padded/truncated
+    uint64_t stringLength;   // Buffer size incl. terminator
+    uint64_t alignment;
+    uint64_t occurrences;
+    double executionTimeMs;
+    double throughputMBps;
+    int32_t threads;
+    char targetCharacter;
+    char reserved[3];        // Padding, keeps the record 8-byte aligned
+};
+#pragma pack(pop)
+
+/**
+ * Append-only writer for the binary results format
+ * Opens the log in append mode and writes the header only when the file
+ * is new, so successive runs and sweep cells accumulate in one file.
+ */
+class BinaryResultsLog {
+public:
+    static const uint32_t kVersion = 1;
+
+    BinaryResultsLog(const std::string& path, const TestConfiguration& config);
+
+    BinaryResultsLog(const BinaryResultsLog&) = delete;
+    BinaryResultsLog& operator=(const BinaryResultsLog&) = delete;
+
+    /**
+     * Append one per-run record (one write, no rewrite of earlier data)
+     */
+    void append(const std::string& implName, size_t stringLength, size_t alignment,
+                char targetChar, int threads, size_t occurrences, double executionTimeMs);
+
+private:
+    std::ofstream file;
+};
 
 #endif // UTILS_H
\ No newline at end of file